@@ -67,6 +67,21 @@ const int VRTREE_API_VERSION_MINOR = 12; //incremented if new exports are added
 #include <stddef.h>
 #include "vrtree_api_types.h"
 
+/// Declares an export that is not yet provided by the vrtree-linker libraries.
+/// Preview exports are only declared when VRTREE_API_PREVIEW is defined (or when building vrtree itself), and
+/// can only be called by clients linking directly to vrtree until the linker libraries are rebuilt with them,
+/// at which point they become ordinary VR_API exports and VRTREE_API_VERSION_MINOR is incremented.
+/// Handles, callbacks, flags and constants used only by preview exports are declared under the same condition in vrtree_api_types.h.
+/// The helpers in vrtree-linker/interface_helpers.hpp call through the linker library, so they do not wrap preview exports.
+#ifdef VR_API_PREVIEW
+#undef VR_API_PREVIEW
+#endif
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+#define VR_API_PREVIEW(returnType, name, params) VR_API(returnType, name, params)
+#else
+#define VR_API_PREVIEW(returnType, name, params)
+#endif
+
 #ifdef VRAPI_INTERNAL
 #ifdef VRAPI_INTERNAL_PFN
 #define VR_INTERNAL_PFN(name) InternalPFN##name name = __vrexport_##name
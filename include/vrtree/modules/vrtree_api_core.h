@@ -125,6 +125,14 @@ VR_API (uint64_t, VRGetUUIDLow, (HNode node));
 /// @permission SC_READ
 VR_API (uint64_t, VRGetUUIDHigh, (HNode node));
 
+/// Gets both halves of a node's unique ID in one call.
+/// @param node handle to the node
+/// @param lo receives the low 64-bits of the UUID
+/// @param hi receives the high 64-bits of the UUID
+/// @return 0 on success
+/// @permission SC_READ
+VR_API_PREVIEW(int, VRGetUUID, (HNode node, uint64_t* lo, uint64_t* hi));
+
 /// Gets the node with the specified UUID
 /// @param lo low 64-bits of the UUID
 /// @param hi high 64-bits of the UUID
@@ -132,6 +140,18 @@ VR_API (uint64_t, VRGetUUIDHigh, (HNode node));
 /// @permission SC_READ
 VR_API (HNode, VRGetNodeFromUUID, (uint64_t lo, uint64_t hi));
 
+/// Gets the nodes with the specified UUIDs.
+///
+/// UUIDs are looked up in a hash index, so this does not search the tree. From the release that provides this function,
+/// ::VRGetNodeFromUUID uses the same index.
+/// @param lohi array of 2 * n values, where lohi[2 * i] and lohi[2 * i + 1] are the low and high 64-bits of the i'th UUID
+/// @param n number of UUIDs in the array
+/// @param out buffer of n node handles to receive the nodes. Entries for UUIDs that do not exist are set to 0.
+/// Every non-zero entry is a new node handle, which must be closed with ::VRCloseNodeHandle.
+/// @return the number of nodes found
+/// @permission SC_READ
+VR_API_PREVIEW(size_t, VRGetNodesFromUUIDs, (const uint64_t* lohi, size_t n, HNode* out));
+
 /// Gets the metanode version of the specified node.
 /// @param node node to query
 /// @return version, or -1 on error / non-existant
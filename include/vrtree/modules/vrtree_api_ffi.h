@@ -197,6 +197,7 @@ VR_API (HFFIVar, VRFFIMakeQuat, (const double* values));
 VR_API (const double*, VRFFIGetQuat, (HFFIVar var));
 
 /// Creates a plane (4 doubles in an array)
+/// The plane is the set of points p where `dot(normal, p) + distance == 0`.
 /// @param values to wrap in the variant. expects an array of 4 doubles (normal xyz, distance)
 /// @return a new FFI variant handle representing the value
 /// @see VRFFIFree(HFFIVar)
@@ -207,6 +207,24 @@ VR_API (int, VRSetMigrationUpgradeNode, (HMigration migration, MigrationUpgradeF
 /// @return 0 if the function is added successfully
 VR_API (int, VRSetMigrationDowngradeNode, (HMigration migration, MigrationDowngradeFunc func));
 
+/// Declares whether the node upgrade and downgrade functions of a migration are thread safe.
+///
+/// When loading, nodes of the same type whose migrations are all thread safe are migrated concurrently on the
+/// file I/O worker threads (see ::VRSetFileIOThreadCount). Nodes are only migrated concurrently if neither is an ancestor of
+/// the other: nested nodes of the same type (e.g. an Assembly beneath an Assembly) are migrated in separate passes, deepest first,
+/// so no worker modifies a subtree that another worker is migrating.
+///
+/// A thread safe function must only read and modify the node it is given, its properties and its descendants, must not touch
+/// its ancestors, siblings or unrelated nodes, and must not rely on the order in which nodes are migrated.
+/// Node replacement through ::VRMigrationCreateCurrentNode and ::VRMigrationFinish is allowed: on a worker thread the new node is
+/// created detached and ::VRMigrationFinish only moves the children of old to it, while deleting old and linking the new node into
+/// old's place in its parent are deferred and performed serially on the loading thread once all workers of the pass have finished.
+/// Migrations are not thread safe by default.
+/// @param migration handle to migration to modify
+/// @param threadSafe non-zero if the node functions of this migration may run concurrently
+/// @return 0 on success
+VR_API_PREVIEW(int, VRSetMigrationThreadSafe, (HMigration migration, int threadSafe));
+
 /// Gets the previous migration in the chain (the one for the version before this one)
 /// @param migration handle to the migration
 /// @return the previous migration or NULL if this is the oldest one
@@ -212,6 +212,46 @@ VR_API (void, VRAddCallbackBreak, (HNode node, EventTwoNodesFunc callback, void*
 /// @param callback the previously added function to remove
 VR_API (void, VRRemoveCallbackBreak, (HNode node, EventTwoNodesFunc callback));
 
+/// Add batched Touch callback, called once per frame with every pair of assemblies that started colliding
+///
+/// Each unordered pair is reported once per frame, in no particular order within the pair (A,B is never also reported as B,A).
+/// Batch callbacks are independent of per-node callbacks: ::VRAddCallbackTouch callbacks still fire for each node of each pair,
+/// and are called before the batch callbacks of the same frame. A client that registers both receives each event through
+/// both, so should use one or the other for a given purpose.
+/// @param callback the function to call
+/// @param userData arbitrary data to pass to the callback
+/// @param flags additional flags for future use (must be zero)
+VR_API_PREVIEW(void, VRAddCallbackTouchBatch, (EventNodePairsFunc callback, void* userData, int flags));
+
+/// Remove batched Touch callback
+/// @param callback the previously added function to remove
+VR_API_PREVIEW(void, VRRemoveCallbackTouchBatch, (EventNodePairsFunc callback));
+
+/// Add batched Break callback, called once per frame with every pair of assemblies that ceased colliding
+///
+/// Pairs are reported, and interact with ::VRAddCallbackBreak callbacks, in the same way as for ::VRAddCallbackTouchBatch.
+/// @param callback the function to call
+/// @param userData arbitrary data to pass to the callback
+/// @param flags additional flags for future use (must be zero)
+VR_API_PREVIEW(void, VRAddCallbackBreakBatch, (EventNodePairsFunc callback, void* userData, int flags));
+
+/// Remove batched Break callback
+/// @param callback the previously added function to remove
+VR_API_PREVIEW(void, VRRemoveCallbackBreakBatch, (EventNodePairsFunc callback));
+
+/// Selects the broad phase used to find candidate pairs for Touch and Break events
+/// @param algorithm one of the @ref api_broadphase "broad phase algorithms"
+/// @param cellSize grid cell size in world units for ::BROADPHASE_UNIFORM_GRID, or 0 to choose automatically. Ignored by other algorithms.
+/// @return 0 on success
+VR_API_PREVIEW(int, VRSetBroadPhase, (uint32_t algorithm, double cellSize));
+
+/// Gets statistics about the broad phase for the most recent frame
+/// @param numBodies receives the number of bodies considered, may be NULL
+/// @param numPairs receives the number of candidate pairs passed to the narrow phase, may be NULL
+/// @param seconds receives the time spent in the broad phase, may be NULL
+/// @return the current broad phase algorithm
+VR_API_PREVIEW(uint32_t, VRGetBroadPhaseStats, (size_t* numBodies, size_t* numPairs, double* seconds));
+
 /// Add Key press callback (key was pressed)
 /// @param callback the function to call
 /// @param userData arbitrary data to pass to the callback
@@ -236,6 +236,30 @@ VR_API (int, VRSetPropertyLink, (HNode node, const char* propName, HNode linkTar
 /// @see VRSetPropertyValueEx()
 VR_API (int, VRSetPropertyLinkEx, (HNode node, uint32_t prop, HNode linkTarget, uint32_t flags, int userChange));
 
+/// Sets a LINK property on a node by the UUID of the target node.
+///
+/// On a node within a build context (see ::VRCreateBuildContext) the link is not resolved immediately; all such links
+/// are resolved together, using the UUID index, when the context is grafted. This allows links to refer to nodes that have not
+/// been created yet. A link still unresolved at graft time is set to NULL; see ::VRGraftSubtree.
+///
+/// Elsewhere the link is resolved immediately. If no node has the UUID, the function fails with ::VRTREE_API_INVALID_PARAMETER
+/// and the property is left unchanged.
+///
+/// From the release that provides this function, loading a file resolves LINK properties the same way: they are collected
+/// and resolved in a single pass, using the UUID index, once all nodes in the file have been created.
+/// @param idLO low 64bits of the target's unique id
+/// @param idHI high 64bits of the target's unique id
+/// @return 0 on success (including a link deferred within a build context)
+/// @see VRSetPropertyValue()
+VR_API_PREVIEW(int, VRSetPropertyLinkUUID, (HNode node, const char* propName, uint64_t idLO, uint64_t idHI));
+
+/// Sets a LINK property on a node by the UUID of the target node.
+/// @param idLO low 64bits of the target's unique id
+/// @param idHI high 64bits of the target's unique id
+/// @return 0 on success
+/// @see VRSetPropertyValueEx()
+VR_API_PREVIEW(int, VRSetPropertyLinkUUIDEx, (HNode node, uint32_t prop, uint64_t idLO, uint64_t idHI, uint32_t flags, int userChange));
+
 /// Sets an array of floats property on a node (useful to set matrices)
 /// @param valueData single precision data to set
 /// @param arraySize the size of the data buffer
@@ -446,6 +470,25 @@ VR_API (HNode, VRGetPropertyLink, (HNode node, const char* propName));
 /// @see VRGetPropertyValueEx()
 VR_API (HNode, VRGetPropertyLinkEx, (HNode node, uint32_t prop));
 
+/// Finds the nodes that have a LINK property pointing at a node.
+///
+/// Referrers are looked up in a reverse link index, so this does not search the tree. The same index is used
+/// to clear links to a node when it is deleted.
+/// @param node the link target
+/// @param out buffer to receive new node handles for the referring nodes. Each handle must be closed with ::VRCloseNodeHandle
+/// @param cap number of handles the buffer can hold
+/// @return the total number of referring nodes, which may be larger than cap
+/// @note if out is null, the function only counts the referring nodes. A node that links to the target
+/// through more than one property is returned once.
+VR_API_PREVIEW(size_t, VRGetLinkReferrers, (HNode node, HNode* out, size_t cap));
+
+/// Finds the LINK properties pointing at a node, and the nodes that hold them.
+/// Unlike ::VRGetLinkReferrers, a node that links to the target through more than one property is returned once per property.
+/// @param props optional buffer of cap property indices to receive the LINK property of each referrer, may be NULL
+/// @return the total number of referring links, which may be larger than cap
+/// @see VRGetLinkReferrers()
+VR_API_PREVIEW(size_t, VRGetLinkReferrersEx, (HNode node, HNode* out, uint32_t* props, size_t cap));
+
 /// Gets a FLOAT array from a node property
 /// @param buffer the buffer to store the data in
 /// @param bufferSize size of the buffer
@@ -488,6 +531,25 @@ VR_API(size_t, VRGetPropertyArrayWorldFloat, (HNode node, const char* propName,
 /// @see VRGetPropertyValueEx()
 VR_API(size_t, VRGetPropertyArrayWorldFloatEx, (HNode node, uint32_t prop, void* buffer, size_t bufferSize));
 
+/// Checks whether a property value is currently shared with another node, e.g. after ::VRCloneNode
+/// @param node node to query
+/// @param propName name of the property to query
+/// @return 1 if the value is shared copy-on-write, 0 if the node holds its own copy
+VR_API_PREVIEW(int, VRIsPropertyShared, (HNode node, const char* propName));
+
+/// Checks whether a property value is currently shared with another node, e.g. after ::VRCloneNode
+/// @param node node to query
+/// @param prop the property to query
+/// @return 1 if the value is shared copy-on-write, 0 if the node holds its own copy
+VR_API_PREVIEW(int, VRIsPropertySharedEx, (HNode node, uint32_t prop));
+
+/// Gets statistics about property values that are shared between nodes, either by ::VRCloneNode or by loading
+/// a file saved with ::FILEIO_DEDUPLICATE
+/// @param numShared receives the number of unique values that are shared by more than one node, may be NULL
+/// @param bytesShared receives the total size of those unique values, may be NULL
+/// @param bytesSaved receives the number of bytes that would be used by unshared copies, less bytesShared, may be NULL
+VR_API_PREVIEW(void, VRGetSharedPropertyStats, (uint64_t* numShared, uint64_t* bytesShared, uint64_t* bytesSaved));
+
 /// Gets the world transform of the specified node from the transform hierarchy.
 /// Internally calls TransformHierarchy::getWorldTransformSafe unless a propName is specified
 /// @param node the node to get the world transform of
@@ -0,0 +1,103 @@
+/*
+MIT License
+
+Copyright (c) 2018 Virtalis Ltd
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/// @file
+
+#ifndef VRAPI_H
+#error api.h must be included before this file
+#endif
+
+/// @defgroup api_query Queries
+/// Functions for finding nodes that match a predicate without walking the tree from the caller
+/// @{
+
+/// Finds all nodes beneath root that match a query expression.
+///
+/// The query is evaluated inside VRTree. Where possible the planner restricts the search to nodes of the
+/// requested type rather than visiting every node, and uses any property index created for the compared property.
+///
+/// A query is made up of terms combined with `and`, `or`, `not` and parentheses. Supported terms are:
+/// - `type=Name` matches nodes of metanode type Name
+/// - `name=text` and `name~'pattern'` match the node name exactly, or against a glob pattern using `*` and `?`
+/// - `Prop op value` compares a property value, where op is one of `=`, `!=`, `<`, `<=`, `>`, `>=` or `~` (glob, strings only).
+///   Components of vector and colour properties are selected with `.x`, `.y`, `.z`, `.w` or `.r`, `.g`, `.b`, `.a`.
+///
+/// String values containing spaces or operators must be quoted with single quotes.
+/// @par Example
+/// @code
+/// size_t n = VRQuery(VRGetScenesNode(), "type=Assembly and Colour.r>0.5 and name~'bolt*'", 0, 0);
+/// @endcode
+/// @param root node to search beneath (root itself is not tested)
+/// @param query the query expression
+/// @param out buffer to receive new node handles for the matching nodes, in depth-first order. Each handle must be closed with ::VRCloseNodeHandle
+/// @param cap number of handles the buffer can hold
+/// @return the total number of matching nodes, which may be larger than cap
+/// @note if out is null, the function only counts the matching nodes.
+/// If the query cannot be parsed, 0 is returned and the error is set to ::VRTREE_API_INVALID_PARAMETER with a description of the syntax error.
+VR_API_PREVIEW(size_t, VRQuery, (HNode root, const char* query, HNode* out, size_t cap));
+
+/// Creates a secondary index on a property of a metanode.
+///
+/// The index covers every instance of the metanode and is kept up to date as property values change, so
+/// lookups never need to visit the tree. Indexes are also used by ::VRQuery for terms that compare the indexed property.
+/// Only single value CHAR, BOOL, INT, FLOAT, DOUBLE, STRING and LINK properties can be indexed, and LINK properties
+/// only support ::PROPERTY_INDEX_HASH because link targets have no meaningful order.
+///
+/// A property has at most one index. To change the kind of an existing index, delete it with ::VRDeletePropertyIndex first.
+/// @param metaName name of the metanode
+/// @param propName name of the property to index
+/// @param kind the @ref api_index_kinds "kind of index" to create
+/// @return 0 on success, or if an index of the same kind already exists. Non-zero if the property already has an index
+/// of the other kind (the error is set to ::VRTREE_API_NOT_ALLOWED and the existing index is kept), or if kind is
+/// ::PROPERTY_INDEX_ORDERED and the property is a LINK (the error is set to ::VRTREE_API_INVALID_PARAMETER).
+VR_API_PREVIEW(int, VRCreatePropertyIndex, (const char* metaName, const char* propName, uint32_t kind));
+
+/// Deletes a secondary index previously created with ::VRCreatePropertyIndex
+/// @param metaName name of the metanode
+/// @param propName name of the indexed property
+/// @return 0 on success
+VR_API_PREVIEW(int, VRDeletePropertyIndex, (const char* metaName, const char* propName));
+
+/// Finds all nodes whose indexed property is equal to a value.
+/// @param metaName name of the metanode
+/// @param propName name of the indexed property
+/// @param valueData buffer containing the value to look up, in the same format accepted by ::VRSetPropertyValue
+/// @param valueSize size of the value buffer
+/// @param out buffer to receive new node handles for the matching nodes. Each handle must be closed with ::VRCloseNodeHandle
+/// @param cap number of handles the buffer can hold
+/// @return the total number of matching nodes, which may be larger than cap
+/// @note if out is null, the function only counts the matching nodes.
+/// If no index exists for the property, 0 is returned and the error is set to ::VRTREE_API_INVALID_PROPERTY.
+VR_API_PREVIEW(size_t, VRLookupByProperty, (const char* metaName, const char* propName, const void* valueData, size_t valueSize, HNode* out, size_t cap));
+
+/// Finds all nodes whose indexed property lies within a range.
+/// Requires an index of kind ::PROPERTY_INDEX_ORDERED. Matching nodes are returned in ascending property order.
+/// @param minData buffer containing the inclusive lower bound
+/// @param maxData buffer containing the inclusive upper bound
+/// @param valueSize size of each bound buffer
+/// @return the total number of matching nodes, which may be larger than cap
+/// @see VRLookupByProperty
+VR_API_PREVIEW(size_t, VRLookupByPropertyRange, (const char* metaName, const char* propName, const void* minData, const void* maxData, size_t valueSize, HNode* out, size_t cap));
+
+/// @}
@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2018 Virtalis Ltd
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/// @file
+
+#ifndef VRAPI_H
+#error api.h must be included before this file
+#endif
+
+/// @defgroup api_spatial Spatial Queries
+/// Functions for finding nodes by their position in the world.
+///
+/// These queries are answered from a bounding volume hierarchy over the world bounds of scene nodes, which is
+/// refitted incrementally when transforms change rather than being rebuilt. Only nodes that carry geometry themselves
+/// have world bounds (the bounds of their own vertex data, transformed to world space); assemblies and other grouping
+/// nodes are not entered in the hierarchy, so a query returns the geometry nodes it hits and not their enclosing ancestors.
+/// Use ::VRComputeBounds for the combined bounds of a subtree. Volumes use the same double precision
+/// layouts as the equivalent FFI types (see ::VRFFIMakeAABB, ::VRFFIMakeSphere, ::VRFFIMakePlane and ::VRFFIMakeRay).
+///
+/// Each function returns new node handles which must be closed with ::VRCloseNodeHandle.
+/// If out is null, the functions only count the matching nodes.
+/// @{
+
+/// Finds all nodes beneath root whose world bounds overlap an axis aligned box.
+/// @param root node to search beneath, or NULL to search all scenes
+/// @param aabb array of 6 doubles (min xyz, max xyz) in world space
+/// @param out buffer to receive new node handles for the overlapping nodes
+/// @param cap number of handles the buffer can hold
+/// @return the total number of overlapping nodes, which may be larger than cap
+VR_API_PREVIEW(size_t, VRQueryAABB, (HNode root, const double* aabb, HNode* out, size_t cap));
+
+/// Finds all nodes beneath root whose world bounds overlap a sphere.
+/// @param root node to search beneath, or NULL to search all scenes
+/// @param sphere array of 4 doubles (centre xyz, radius) in world space
+/// @param out buffer to receive new node handles for the overlapping nodes
+/// @param cap number of handles the buffer can hold
+/// @return the total number of overlapping nodes, which may be larger than cap
+VR_API_PREVIEW(size_t, VRQuerySphere, (HNode root, const double* sphere, HNode* out, size_t cap));
+
+/// Finds all nodes beneath root whose world bounds are at least partially inside a convex volume.
+/// @param root node to search beneath, or NULL to search all scenes
+/// @param planes array of 4 doubles per plane (normal xyz, distance) in world space, in the same form as ::VRFFIMakePlane.
+/// A point p is inside a plane when `dot(normal, p) + distance >= 0`, so normals point into the volume. A view frustum uses 6 planes.
+/// @param numPlanes number of planes in the planes array
+/// @param out buffer to receive new node handles for the contained nodes
+/// @param cap number of handles the buffer can hold
+/// @return the total number of contained nodes, which may be larger than cap
+VR_API_PREVIEW(size_t, VRQueryFrustum, (HNode root, const double* planes, size_t numPlanes, HNode* out, size_t cap));
+
+/// Finds all nodes beneath root whose world bounds are hit by a ray, nearest first.
+/// @param root node to search beneath, or NULL to search all scenes
+/// @param ray array of 6 doubles (origin xyz, direction xyz) in world space. The direction need not be normalised,
+/// but must not be zero length; it is normalised before testing, so the ray has no maximum length.
+/// @param out buffer to receive new node handles for the nodes that were hit
+/// @param distances optional buffer of cap doubles to receive the distance in world units from the ray origin to where
+/// the ray enters each node's bounds (0 if the origin is inside them), may be NULL
+/// @param cap number of handles the buffers can hold
+/// @return the total number of nodes hit, which may be larger than cap
+/// @note hits are tested against node bounds, not geometry.
+VR_API_PREVIEW(size_t, VRRaycast, (HNode root, const double* ray, HNode* out, double* distances, size_t cap));
+
+/// Computes the bounds of all geometry beneath a node.
+///
+/// The subtree is split across worker threads, and the bounds of each node are cached so that repeated calls
+/// only recompute branches that have changed since the last call. A node's cached bounds, and those of its ancestors, are
+/// invalidated when its vertex data or transform changes, when a child is added, removed or reparented beneath it, and, for
+/// calls with ::BOUNDS_VISIBLE_ONLY, when the visibility of it or a descendant changes.
+/// @param root the node to compute the bounds of
+/// @param flags zero or more @ref api_bounds_flags
+/// @param outAABB array of 6 doubles to receive the bounds (min xyz, max xyz)
+/// @return 0 on success, or non-zero if the subtree contains no geometry
+VR_API_PREVIEW(int, VRComputeBounds, (HNode root, uint32_t flags, double* outAABB));
+
+/// @}
@@ -65,6 +65,25 @@ VR_API (HNode, VRLoadTree, (HNode targetNode, const char* fileName));
 /// @return The first new child of targetNode, or NULL if load failed
 VR_API(HNode, VRLoadTreeEx, (HNode targetNode, const char* fileName, uint64_t ioFlags, uint32_t builderFlags, uint32_t builderMetaFlags));
 
+/// Sets the number of worker threads used for file I/O.
+///
+/// When loading, files are split into independently decodable chunks which are decoded and validated in parallel.
+/// The resulting tree is assembled in file order, so the result does not depend on the number of threads.
+///
+/// When saving without ::FILEIO_MONOLITHIC, each library archive is serialised and compressed in parallel, and
+/// the index and archives are then committed to disk in one ordered step.
+///
+/// The count limits how many chunks or archives are decoded or encoded in parallel. A count of 1 does this work on the calling
+/// thread for ::VRLoadTreeEx and ::VRSaveTreeEx. Work that never runs on the calling thread, such as ::VRSaveTreeAsync and
+/// ::VRPrefetchSubtree, always uses at least one background thread, and uses at most this many at a time.
+/// @param numThreads maximum number of parallel decode and encode workers, or 0 to use one per hardware thread
+/// @return the previous thread count
+VR_API_PREVIEW(uint32_t, VRSetFileIOThreadCount, (uint32_t numThreads));
+
+/// Gets the number of worker threads used for file I/O.
+/// @return the value set by ::VRSetFileIOThreadCount (0 means one per hardware thread)
+VR_API_PREVIEW(uint32_t, VRGetFileIOThreadCount, (void));
+
 /// Saves the tree to a VRText or VRNative format file on disk.
 /// @param rootNode the node to start saving from (usually root)
 /// @param fileName the full path to the file to save to
@@ -77,6 +96,209 @@ VR_API (int, VRSaveTree, (HNode rootNode, const char* fileName));
 /// @return 0 if the save was successful.
 VR_API(int, VRSaveTreeEx, (HNode rootNode, const char* fileName, uint64_t ioFlags));
 
+/// Gets statistics about the most recent completed save.
+/// @param bytesWritten receives the total number of bytes written, including library archives, may be NULL
+/// @param numArchives receives the number of library archives written, may be NULL
+/// @param serialiseSeconds receives the total time spent serialising and compressing, summed over all worker threads, may be NULL
+/// @param elapsedSeconds receives the wall clock time taken by the save, may be NULL
+/// @param numDeduplicated receives the number of property values written as references to an identical payload
+/// under ::FILEIO_DEDUPLICATE (0 without the flag), may be NULL
+/// @param bytesDeduplicated receives the number of payload bytes those references avoided writing, may be NULL
+/// @return 0 on success, or non-zero if no save has completed yet
+VR_API_PREVIEW(int, VRGetLastSaveStats, (uint64_t* bytesWritten, uint32_t* numArchives, double* serialiseSeconds, double* elapsedSeconds, uint64_t* numDeduplicated, uint64_t* bytesDeduplicated));
+
+/// Creates an empty load filter for ::VRLoadTreeFiltered.
+///
+/// A filter selects nodes in two steps. First, if any paths or libraries have been added, only nodes at or beneath one
+/// of the paths, or within one of the libraries, are selected (the union of both lists), along with their ancestors; if neither
+/// list has entries, every node is selected. Second, nodes of any skipped type are removed from the selection, along with their descendants.
+/// For example, adding the path "Scenes" and the library "X" loads all scenes plus library X.
+/// An empty filter loads everything.
+/// @return load filter handle, or 0 on error
+VR_API_PREVIEW(HLoadFilter, VRCreateLoadFilter, (void));
+
+/// Adds a path to the set of branches selected by a load filter.
+/// @see VRCreateLoadFilter for how paths, libraries and skipped types combine
+/// @param filter the load filter
+/// @param path path of a node within the file, in the same form as ::VRGetNodePath (e.g. "Scenes/Cell")
+/// @return 0 on success
+VR_API_PREVIEW(int, VRLoadFilterAddPath, (HLoadFilter filter, const char* path));
+
+/// Excludes all nodes of a type, along with their descendants, from a load filter.
+/// Skipped types take precedence over added paths and libraries.
+/// @param filter the load filter
+/// @param metaName the type of node to skip
+/// @return 0 on success
+VR_API_PREVIEW(int, VRLoadFilterSkipType, (HLoadFilter filter, const char* metaName));
+
+/// Adds a named library to the set of branches selected by a load filter.
+/// @see VRCreateLoadFilter for how paths, libraries and skipped types combine
+/// @param filter the load filter
+/// @param libraryName name of a library node to load
+/// @return 0 on success
+VR_API_PREVIEW(int, VRLoadFilterAddLibrary, (HLoadFilter filter, const char* libraryName));
+
+/// Closes a load filter.
+/// @param filter handle to close. Becomes unusable.
+VR_API_PREVIEW(void, VRCloseLoadFilter, (HLoadFilter filter));
+
+/// Loads part of a VRText or VRNative format file from disk.
+///
+/// For VRNative files with a table of contents (see ::VRReadFileIndex), branches excluded by the filter are skipped
+/// without being decoded, and library archives excluded by the filter are not opened.
+///
+/// LINK properties whose target was excluded read as NULL, but keep the target's UUID and are resolved if the target
+/// is loaded later (e.g. by another filtered load of the same file). Such links are not cleared when the property is read.
+///
+/// A partially loaded tree does not contain the excluded content, so saving it back over fileName would silently drop that content.
+/// The loaded nodes are therefore marked as partial, and ::VRSaveTree, ::VRSaveTreeEx and ::VRSaveTreeAsync refuse to overwrite
+/// fileName with them (failing with ::VRTREE_API_NOT_ALLOWED) unless ::FILEIO_FORCE_SAVE is given. Saving to a different file is allowed.
+/// @param targetNode the node to load the file onto (usually root)
+/// @param fileName the full path to the file to load
+/// @param ioFlags Input flags to apply while loading the tree
+/// @param builderFlags flags which adjust the behaviour of the builder
+/// @param builderMetaFlags additional MetaNode flags applied to nodes created by the tree builder
+/// @param filter filter describing which nodes to load, or NULL to load everything
+/// @return The first new child of targetNode, or NULL if load failed
+VR_API_PREVIEW(HNode, VRLoadTreeFiltered, (HNode targetNode, const char* fileName, uint64_t ioFlags, uint32_t builderFlags, uint32_t builderMetaFlags, HLoadFilter filter));
+
+/// Reads the table of contents of a VRNative file without loading the tree.
+///
+/// VRNative files record the byte range, UUID and node count of every library and top-level assembly
+/// in an index block, which is written on every full save. The callback is called once for each indexed node, in file order.
+/// The index is stored as an optional block that earlier versions skip when loading, so writing it does not affect
+/// which versions can read the file.
+///
+/// Saves with ::FILEIO_JOURNAL do not rewrite the index, so when a journal exists the index describes the file as of its
+/// last full save and does not reflect the journalled changes. Use ::VRGetJournalSize to detect this, and ::VRCompactJournal to bring the index up to date.
+/// @param fileName the full path to the file
+/// @param callback function called for each entry
+/// @param userData arbitrary data to pass to the callback
+/// @return 0 on success, or non-zero if the file could not be read or has no table of contents (e.g. VRText files, or files saved by older versions)
+VR_API_PREVIEW(int, VRReadFileIndex, (const char* fileName, FileIndexFunc callback, void* userData));
+
+/// Reads the number of nodes of each type in a VRNative file without loading the tree.
+/// @param fileName the full path to the file
+/// @param callback function called once for each node type in the file
+/// @param userData arbitrary data to pass to the callback
+/// @return 0 on success, or non-zero if the file could not be read or has no table of contents
+/// @see VRReadFileIndex
+VR_API_PREVIEW(int, VRReadFileTypeCounts, (const char* fileName, FileTypeCountFunc callback, void* userData));
+
+/// Starts loading any placeholder libraries within a subtree on a background thread.
+///
+/// Placeholders are created when loading with ::FILEIO_LAZY_LIBRARIES. Accessing a placeholder that is still
+/// being prefetched waits for its archive to finish loading rather than loading it a second time.
+/// @param node the root of the subtree to prefetch
+/// @return 0 on success (including when there is nothing to prefetch)
+VR_API_PREVIEW(int, VRPrefetchSubtree, (HNode node));
+
+/// Checks whether a node is a placeholder whose archive has not yet been loaded.
+/// This does not cause the archive to be loaded.
+/// @param node handle to the node
+/// @return 1 if the node is an unloaded placeholder, 0 otherwise
+VR_API_PREVIEW(int, VRIsPlaceholder, (HNode node));
+
+/// Loads a VRText or VRNative format file from a memory buffer.
+/// @param targetNode the node to load the file onto (usually root)
+/// @param data buffer containing the file contents. The buffer is not referenced after the function returns.
+/// @param dataSize size of the buffer
+/// @param ioFlags Input flags to apply while loading the tree. ::FILEIO_FILE_FORMAT_GUESS detects the format from the file header.
+/// @param builderFlags flags which adjust the behaviour of the builder
+/// @param builderMetaFlags additional MetaNode flags applied to nodes created by the tree builder
+/// @return The first new child of targetNode, or NULL if load failed
+/// @note there is no file name to resolve separate library archives against, so the data must have been saved with ::FILEIO_MONOLITHIC.
+VR_API_PREVIEW(HNode, VRLoadTreeFromMemory, (HNode targetNode, const void* data, size_t dataSize, uint64_t ioFlags, uint32_t builderFlags, uint32_t builderMetaFlags));
+
+/// Loads a VRText or VRNative format file from a stream.
+/// @param targetNode the node to load the file onto (usually root)
+/// @param readFunc function called to read data from the stream
+/// @param seekFunc function called to reposition the stream, or NULL if the stream cannot seek (the data is then buffered in memory)
+/// @param userData arbitrary data to pass to the stream functions
+/// @param ioFlags Input flags to apply while loading the tree. ::FILEIO_FILE_FORMAT_GUESS detects the format from the start of the stream.
+/// @param builderFlags flags which adjust the behaviour of the builder
+/// @param builderMetaFlags additional MetaNode flags applied to nodes created by the tree builder
+/// @return The first new child of targetNode, or NULL if load failed
+/// @see VRLoadTreeFromMemory
+VR_API_PREVIEW(HNode, VRLoadTreeFromStream, (HNode targetNode, StreamReadFunc readFunc, StreamSeekFunc seekFunc, void* userData, uint64_t ioFlags, uint32_t builderFlags, uint32_t builderMetaFlags));
+
+/// Saves the tree to a VRText or VRNative format file in memory.
+/// @param rootNode the node to start saving from (usually root).
+/// @param ioFlags @ref api_io_flags to apply while saving the tree. ::FILEIO_MONOLITHIC is implied.
+/// Either ::FILEIO_FILE_FORMAT_MACHINE or ::FILEIO_FILE_FORMAT_HUMAN is required, as there is no file extension to guess
+/// the format from; ::FILEIO_FILE_FORMAT_GUESS or no format flag fails the save with ::VRTREE_API_INVALID_PARAMETER.
+/// @param outData receives a pointer to the saved data, which must be released with ::VRFreeTreeMemory
+/// @param outSize receives the size of the saved data
+/// @return 0 if the save was successful.
+VR_API_PREVIEW(int, VRSaveTreeToMemory, (HNode rootNode, uint64_t ioFlags, void** outData, size_t* outSize));
+
+/// Releases data returned by ::VRSaveTreeToMemory
+/// @param data pointer returned by ::VRSaveTreeToMemory, may be NULL
+VR_API_PREVIEW(void, VRFreeTreeMemory, (void* data));
+
+/// Saves the tree to a VRText or VRNative format file through a stream.
+/// @param rootNode the node to start saving from (usually root).
+/// @param writeFunc function called to write data to the stream
+/// @param seekFunc function called to reposition the stream, or NULL if the stream cannot seek. Without it, sections whose
+/// size or offset is only known once later data has been written (e.g. the VRNative table of contents) cannot be patched
+/// in place, so the whole file is assembled in memory and written sequentially once complete; this never causes the save to fail.
+/// @param userData arbitrary data to pass to the stream functions
+/// @param ioFlags @ref api_io_flags to apply while saving the tree. ::FILEIO_MONOLITHIC is implied.
+/// Either ::FILEIO_FILE_FORMAT_MACHINE or ::FILEIO_FILE_FORMAT_HUMAN is required, as there is no file extension to guess
+/// the format from; ::FILEIO_FILE_FORMAT_GUESS or no format flag fails the save with ::VRTREE_API_INVALID_PARAMETER.
+/// @return 0 if the save was successful.
+VR_API_PREVIEW(int, VRSaveTreeToStream, (HNode rootNode, StreamWriteFunc writeFunc, StreamSeekFunc seekFunc, void* userData, uint64_t ioFlags));
+
+/// Folds a journal into its VRNative file on disk, without loading the file into the tree.
+///
+/// The file and its journal are read, the journalled changes are replayed onto them, and the result is written as a full
+/// file with a new save ID (see ::FILEIO_JOURNAL). This is useful for files that are not currently loaded; a loaded tree can
+/// equally be compacted by saving it without ::FILEIO_JOURNAL.
+/// If the journal does not match the file it is left in place and the function fails; if there is no journal the file is left unchanged.
+/// @param fileName the full path to the file previously saved with ::FILEIO_JOURNAL
+/// @param ioFlags @ref api_io_flags to apply while writing the compacted file (e.g. ::FILEIO_COMPRESS_LZ4)
+/// @return 0 if the compaction was successful, or there was no journal.
+VR_API_PREVIEW(int, VRCompactJournal, (const char* fileName, uint64_t ioFlags));
+
+/// Gets the size of the journal written since the last full save.
+/// Callers can use this to decide when to call ::VRCompactJournal.
+/// @param fileName the full path to the file previously saved with ::FILEIO_JOURNAL
+/// @return size of the journal in bytes, or 0 if there is no journal
+VR_API_PREVIEW(uint64_t, VRGetJournalSize, (const char* fileName));
+
+/// Saves the tree to a VRText or VRNative format file on disk without blocking the caller.
+///
+/// A copy-on-write snapshot of the subtree is taken before this function returns, so the tree may be modified
+/// immediately afterwards without affecting the saved file. Serialisation, compression and writing happen on background threads.
+///
+/// Saves to the same file never overlap. A second ::VRSaveTreeAsync to a file with a save still in flight is queued and
+/// written after it, and ::VRSaveTree, ::VRSaveTreeEx or ::VRCompactJournal on that file first wait for pending saves to complete.
+/// @param rootNode the node to start saving from (usually root).
+/// @param fileName the full path to the file to save to.
+/// @param ioFlags @ref api_io_flags to apply while saving the tree
+/// @param callback optional function to call on the main thread when the save completes, may be NULL.
+/// It is called from the next ::VRUpdate or ::VRWaitAsyncIO after completion, whichever comes first, and is only ever called once.
+/// @param userData arbitrary data to pass to the callback
+/// @return handle to the pending save, or 0 if the snapshot could not be taken. Close with ::VRCloseAsyncIOHandle.
+VR_API_PREVIEW(HAsyncIO, VRSaveTreeAsync, (HNode rootNode, const char* fileName, uint64_t ioFlags, AsyncIOCompleteFunc callback, void* userData));
+
+/// Checks whether an asynchronous file operation has completed.
+/// @param op handle to the operation
+/// @return 1 if the operation has completed, 0 if it is still in progress
+VR_API_PREVIEW(int, VRIsAsyncIOComplete, (HAsyncIO op));
+
+/// Blocks until an asynchronous file operation has completed.
+/// If the completion callback has not been called yet, it is called before this function returns, so callers that
+/// never call ::VRUpdate (e.g. headless batch tools) still receive it.
+/// @param op handle to the operation
+/// @return the result of the operation (0 on success)
+VR_API_PREVIEW(int, VRWaitAsyncIO, (HAsyncIO op));
+
+/// Closes an asynchronous file operation handle.
+/// Closing the handle does not cancel the operation, and the completion callback is still called.
+/// @param op handle to close. Becomes unusable.
+VR_API_PREVIEW(void, VRCloseAsyncIOHandle, (HAsyncIO op));
+
 /// Compares all the properties on both nodes to make sure they are equal.
 /// @param lhs first node to compare
 /// @param rhs second node to compare
@@ -84,6 +306,52 @@ VR_API(int, VRSaveTreeEx, (HNode rootNode, const char* fileName, uint64_t ioFlag
 /// @return 1 if the nodes are the same, 0 if they are not
 VR_API (int, VRCompareNode, (HNode lhs, HNode rhs, int checkNameMatches));
 
+/// Gets a 128-bit content hash of a node and all of its descendants.
+///
+/// The hash folds in the node type, name, property values and the hashes of its children in order.
+/// Node UUIDs are not included, so clones of a subtree have the same hash; LINK properties contribute
+/// the UUID of their target. Hashes are computed lazily and cached, and are invalidated up the ancestor
+/// chain whenever a node is modified, so repeated calls on an unchanged subtree are O(1).
+/// @param node the root of the subtree to hash
+/// @param out array of 2 values to receive the low and high 64 bits of the hash
+/// @return 0 on success
+VR_API_PREVIEW(int, VRGetSubtreeHash, (HNode node, uint64_t out[2]));
+
+/// Gets a 128-bit identity hash of a node and all of its descendants.
+///
+/// Unlike ::VRGetSubtreeHash, this hash covers only the structure of the subtree: the UUID of each node and the
+/// identity hashes of its children in order. Two subtrees with the same identity hash contain the same nodes in the same places.
+/// It is cached and invalidated in the same way as ::VRGetSubtreeHash.
+/// @param node the root of the subtree to hash
+/// @param out array of 2 values to receive the low and high 64 bits of the hash
+/// @return 0 on success
+VR_API_PREVIEW(int, VRGetSubtreeIdentityHash, (HNode node, uint64_t out[2]));
+
+/// Compares two subtrees and reports the differences between them.
+///
+/// The two subtrees are usually two versions of the same content, for example a branch of the tree and a copy of it loaded
+/// (without ::FILEIO_NEW_UUIDS) onto the root of a build context (see ::VRGetBuildContextRoot). Nodes in a build context are
+/// not entered in the UUID index until they are grafted, so the same UUIDs may exist both there and in the tree.
+/// Within each of a and b, UUIDs must be unique; if either subtree contains a UUID twice the function fails with
+/// ::VRTREE_API_INVALID_PARAMETER without calling the callback.
+///
+/// Nodes are matched by UUID. A branch is skipped without being visited only when both its ::VRGetSubtreeHash and
+/// its ::VRGetSubtreeIdentityHash values are equal, so the cost is proportional to the size of the changes rather than the
+/// size of the subtrees. Branches with equal content but different UUIDs (e.g. a node deleted and recreated with the same
+/// values, or identical siblings that have swapped UUIDs) are still visited and reported as created, deleted or moved.
+///
+/// A node whose matched parent differs is always reported as ::DIFF_MOVED. Among the matched children of the same parent, sibling
+/// order is compared relative to each other rather than by index: the largest set of children whose relative order is unchanged
+/// is left unreported, and only the remaining children are reported as moved. Inserting or deleting a child therefore does
+/// not report its later siblings as moved.
+/// The node handles passed to the callback are only valid for the duration of the callback.
+/// @param a root of the original subtree
+/// @param b root of the modified subtree
+/// @param callback function called once for each change found
+/// @param userData arbitrary data to pass to the callback
+/// @return 0 on success
+VR_API_PREVIEW(int, VRDiffSubtrees, (HNode a, HNode b, NodeDiffFunc callback, void* userData));
+
 /// Creates a node.
 /// @param parentNode Handle to the parent of the new node
 /// @param metaName type of node to create
@@ -127,6 +395,18 @@ VR_API (HNode, VRFindOrCreateChildEx, (HNode parentNode, const char* metaName, c
 /// @return the copy of nodeToClone
 VR_API (HNode, VRCloneNode, (HNode parentNode, HNode nodeToClone, int recursive));
 
+/// Clones an existing node
+///
+/// Unless ::CLONE_DEEP_COPY is given, property values are shared with nodeToClone copy-on-write; a clone only receives
+/// its own copy of a property value the first time that property is written on either node. From the release that provides
+/// this function, ::VRCloneNode shares property values in the same way.
+/// @param parentNode Handle to the parent of the new node
+/// @param nodeToClone the node to copy
+/// @param cloneFlags one or more @ref api_clone_flags controlling the clone
+/// @return the copy of nodeToClone
+/// @see VRCloneNode
+VR_API_PREVIEW(HNode, VRCloneNodeEx, (HNode parentNode, HNode nodeToClone, uint32_t cloneFlags));
+
 /// Deletes a node and all its children
 /// @param node the node to delete
 /// @return 0 if deletion successful
@@ -282,4 +562,53 @@ VR_API(int, VRSetParentEx, (HNode node, HNode parent, HNode afterSibling));
 /// Gets the metanode of a node
 /// @return metanode or NULL if no metanode
 VR_API(HMeta, VRGetMetaNode, (HNode node));
+
+/// Creates a detached build context.
+///
+/// A build context owns a root node that is not attached to the VRTree. Nodes created beneath it
+/// (using ::VRCreateNode or any other node creation function) and properties set on them do not notify
+/// observers, are not recorded in the undo/redo history and are not sent to connected instances.
+/// The finished subtree is attached to the tree with a single call to ::VRGraftSubtree.
+///
+/// A build context may be populated from a thread other than the main thread, provided that only one
+/// thread accesses it at a time.
+///
+/// Until they are grafted, nodes in a build context are not entered in the UUID index or in property indexes, and are not
+/// tracked by the spatial bounds cache. ::VRGetNodeFromUUID, ::VRGetNodesFromUUIDs, ::VRLookupByProperty and
+/// ::VRLookupByPropertyRange therefore do not find them. ::VRQuery and the spatial queries (e.g. ::VRQueryAABB) search a build context
+/// only when given a node within it as their root; queries rooted in the tree never return nodes in a build context.
+/// @return build context handle, or 0 on error
+VR_API_PREVIEW(HBuildContext, VRCreateBuildContext, (void));
+
+/// Gets the detached root node of a build context.
+/// @param context the build context
+/// @return handle to the root node of the build context, or NULL if the context is invalid
+/// @note the root node itself is never grafted, only its children.
+VR_API_PREVIEW(HNode, VRGetBuildContextRoot, (HBuildContext context));
+
+/// Attaches the contents of a build context to the tree.
+///
+/// All children of the build context root are moved to the end of parent's children in one operation.
+/// Observers are notified once for each grafted node, as if the nodes had been created in place, and the
+/// graft is recorded as a single undo/redo history entry.
+///
+/// UUIDs must be unique within the tree. If any node in the context has the UUID of a node already in the tree (e.g. one set
+/// with ::VRCreateNodeEx, or a copy of a file that is already loaded), the graft fails with ::VRTREE_API_INVALID_PARAMETER before
+/// anything is moved, leaving the context and the tree unchanged. Nodes are never given new UUIDs or merged by a graft;
+/// load with ::FILEIO_NEW_UUIDS to graft a second copy of the same content.
+///
+/// The grafted subtree is sent to connected instances (see ::VRConnect) as a single batch, which each instance
+/// applies as one graft with the same observer and history behaviour. Nothing is sent for the nodes while they are being built.
+/// Links set with ::VRSetPropertyLinkUUID are resolved in one pass before observers are notified. Links whose UUID matches
+/// no node (in the context or the tree) are set to NULL, and a warning giving their number is recorded; they do not cause the graft to fail.
+/// The build context is left empty and may be reused.
+/// @param context the build context to graft
+/// @param parent the node to attach the subtree to
+/// @return 0 on success
+/// @note must be called from the main thread.
+VR_API_PREVIEW(int, VRGraftSubtree, (HBuildContext context, HNode parent));
+
+/// Closes a build context, deleting any nodes that have not been grafted.
+/// @param context handle to close. Becomes unusable.
+VR_API_PREVIEW(void, VRCloseBuildContext, (HBuildContext context));
 /// @}
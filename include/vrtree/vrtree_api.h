@@ -38,4 +38,6 @@ SOFTWARE.
 #include "modules/vrtree_api_migrations.h"
 #include "modules/vrtree_api_ffi.h"
 #include "modules/vrtree_api_utilities.h"
-#include "modules/vrtree_api_settings.h"
\ No newline at end of file
+#include "modules/vrtree_api_settings.h"
+#include "modules/vrtree_api_query.h"
+#include "modules/vrtree_api_spatial.h"
\ No newline at end of file
@@ -53,6 +53,17 @@ typedef struct UserDataHandle* HUserSlot;
 /// A handle to a security context
 typedef struct SecurityContextHandle* HAuth;
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// A handle to a detached build context
+typedef struct BuildContextHandle* HBuildContext;
+
+/// A handle to an asynchronous file operation
+typedef struct AsyncIOHandle* HAsyncIO;
+
+/// A handle to a load filter
+typedef struct LoadFilterHandle* HLoadFilter;
+#endif
+
 #ifndef EXCLUDE_TEXINFO
 typedef struct _TextureInfo
 {
@@ -146,6 +157,53 @@ typedef void(*NodeChildRemovedFunc)(HNode parent, HNode child, void* userData);
 /// @param userData arbitrary user data that was provided when registering the callback
 typedef void(*NodeParentChangedFunc)(HNode node, HNode newParent, HNode oldParent, void* userData);
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// Signature of a function that is called when an asynchronous file operation completes
+/// @param result the result of the operation (0 on success)
+/// @param userData arbitrary user data that was provided when starting the operation
+typedef void(*AsyncIOCompleteFunc)(int result, void* userData);
+
+/// Signature of a function that reads from a stream for ::VRLoadTreeFromStream
+/// @param buffer buffer to receive the data
+/// @param size number of bytes requested
+/// @param userData arbitrary user data that was provided when starting the load
+/// @return number of bytes read, which is less than size only at the end of the stream, or (size_t)-1 if the read failed,
+/// which fails the load
+typedef size_t(*StreamReadFunc)(void* buffer, size_t size, void* userData);
+
+/// Signature of a function that writes to a stream for ::VRSaveTreeToStream
+/// @param data the data to write
+/// @param size number of bytes to write
+/// @param userData arbitrary user data that was provided when starting the save
+/// @return number of bytes written, anything less than size aborts the save
+typedef size_t(*StreamWriteFunc)(const void* data, size_t size, void* userData);
+
+/// Signature of a function that repositions a stream
+/// @param offset offset in bytes relative to origin
+/// @param origin 0 for the start of the stream, 1 for the current position, 2 for the end of the stream (as SEEK_SET, SEEK_CUR, SEEK_END)
+/// @param userData arbitrary user data that was provided when starting the operation
+/// @return the new position from the start of the stream, or -1 on error
+typedef int64_t(*StreamSeekFunc)(int64_t offset, int origin, void* userData);
+
+/// Signature of a function that receives entries from the table of contents of a VRNative file (see ::VRReadFileIndex)
+/// @param path path of the indexed node within the file
+/// @param metaName type of the indexed node (e.g. a library or top-level assembly)
+/// @param idLO low 64bits of the node's unique id
+/// @param idHI high 64bits of the node's unique id
+/// @param archive full path to the library archive holding the node's data, or NULL if the data is in the indexed file itself
+/// @param offset byte offset of the node's data within the file named by archive (or the indexed file if archive is NULL)
+/// @param size size in bytes of the node's data, including its descendants
+/// @param numNodes number of nodes in the subtree, including the indexed node
+/// @param userData arbitrary user data that was provided when calling ::VRReadFileIndex
+typedef void(*FileIndexFunc)(const char* path, const char* metaName, uint64_t idLO, uint64_t idHI, const char* archive, uint64_t offset, uint64_t size, uint64_t numNodes, void* userData);
+
+/// Signature of a function that receives node type counts from the table of contents of a VRNative file (see ::VRReadFileTypeCounts)
+/// @param metaName a node type present in the file
+/// @param count number of nodes of that type in the file
+/// @param userData arbitrary user data that was provided when calling ::VRReadFileTypeCounts
+typedef void(*FileTypeCountFunc)(const char* metaName, uint64_t count, void* userData);
+#endif
+
 /// Signature of a function that is called every frame
 /// @param deltaTime the time (in seconds) since the last frame
 /// @param userData arbitrary user data that was provided when registering the callback
@@ -178,6 +236,15 @@ typedef void(*EventTwoNodesUserFunc)(HNode node, HNode other, HNode user, void*
 /// @param userData arbitrary user data that was provided when registering the callback
 typedef void(*EventTwoNodesFunc)(HNode node, HNode other, void* userData);
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// Signature of a function that receives all interactions of one kind found during a frame (for event observers)
+/// @param nodes array of 2 * numPairs node handles, where nodes[2 * i] and nodes[2 * i + 1] form the i'th interacting pair
+/// @param numPairs number of pairs in the array
+/// @param userData arbitrary user data that was provided when registering the callback
+/// @note the handles in the array are only valid for the duration of the callback.
+typedef void(*EventNodePairsFunc)(const HNode* nodes, size_t numPairs, void* userData);
+#endif
+
 /// Signature of a function that is called when a key state is changed (for event observers)
 /// @param code key code
 /// @param code key state
@@ -191,6 +258,16 @@ typedef void(*EventKeyFunc)(int code, int state, HNode user, void* userData);
 /// @param userData arbitrary user data that was provided when registering the callback
 typedef void(*EventGestureFunc)(int code, HNode user, void* userData);
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// Signature of a function that receives changes reported by ::VRDiffSubtrees
+/// @param change the kind of change (one of the @ref api_diff_changes)
+/// @param from the node in the first subtree, or NULL if the node was created
+/// @param to the matching node in the second subtree, or NULL if the node was deleted
+/// @param prop index of the changed property for ::DIFF_PROPERTY_CHANGED, otherwise ::PROPERTY_INVALID_INDEX
+/// @param userData arbitrary user data that was provided when calling ::VRDiffSubtrees
+typedef void(*NodeDiffFunc)(uint32_t change, HNode from, HNode to, uint32_t prop, void* userData);
+#endif
+
 /// @}
 
 /// @defgroup api_flags Flags
@@ -273,6 +350,56 @@ const uint64_t FILEIO_SYSTEM_DOCUMENT = ((uint64_t)1 << 8);
 /// Signals that the document should be saved as a system document.
 const uint64_t FILEIO_OVERLAY_DOCUMENT = ((uint64_t)1 << 9);
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// Signals that a VRNative file should be memory mapped while loading. Large property values (e.g. vertex vectors and DDS data)
+/// reference the mapped file directly instead of being copied, until they are first written. The file remains mapped
+/// while any such value exists. Saving over a mapped file is allowed: the save is written to a temporary file next to it,
+/// any values still referencing the old mapping are copied into memory, and the temporary file then replaces the original.
+/// Only values stored uncompressed can reference the mapping; values in blocks compressed with ::FILEIO_COMPRESS_LZ4 or
+/// ::FILEIO_COMPRESS_ZSTD are decompressed into memory as usual. The flag is ignored for VRText files, which are always parsed
+/// into memory, and the file is not kept mapped if no values reference it.
+const uint64_t FILEIO_MEMORY_MAPPED = ((uint64_t)1 << 10);
+
+/// Signals that a save should append the node-level changes made since the last full save to a journal file (the file name
+/// with a `.journal` suffix) instead of rewriting the file. The journal records node creations and deletions, property changes,
+/// renames, reparenting and changes of sibling order, so replaying it reproduces the saved tree exactly.
+///
+/// The journal header records the save ID of the full file it was written against. When loading, a journal next to the file
+/// is only replayed if its save ID matches the file; a journal that does not match (e.g. next to a copy of an older file) is
+/// ignored with a warning. Any save that rewrites the full file (a save without this flag, the first save with it, or
+/// ::VRCompactJournal) writes a new save ID and removes the journal, so a plain save of the loaded tree also compacts it.
+/// The new file is written to a temporary file that replaces the original, and the journal is only removed once that has
+/// succeeded; an interrupted or failed full save leaves the previous file and journal intact, and a journal left behind after
+/// the file was replaced no longer matches its save ID and is ignored.
+/// Use ::VRCompactJournal to fold the journal back into a full VRNative file without loading it.
+const uint64_t FILEIO_JOURNAL = ((uint64_t)1 << 11);
+
+/// Signals that Library nodes saved as separate archives should be loaded as placeholders. A library's archive is only
+/// decoded the first time one of its properties or children is accessed, or when ::VRPrefetchSubtree is called.
+///
+/// Decoding a placeholder does not notify observers from within the call that triggered it; NodeCreated and NodeChildAdded
+/// for the library's contents are delivered at the next ::VRUpdate, as for a normal load.
+///
+/// Saving never writes an empty library for a placeholder. Saves that write separate library archives copy an unloaded
+/// library's archive unchanged without decoding it. Saves that embed libraries (::FILEIO_MONOLITHIC, ::VRSaveTreeToMemory
+/// and ::VRSaveTreeToStream) decode the placeholder first; ::VRSaveTreeAsync does so on its background threads.
+///
+/// The size and save ID of each archive are recorded when the placeholder is created. If a deferred decode fails because the
+/// archive is missing, corrupt or no longer matches what was recorded, the call that triggered it behaves as if the library
+/// were empty (it has no children and its properties read as defaults) and the error, naming the archive, is reported through
+/// ::VRGetLastError and ::VRGetLastErrorString. The library remains a placeholder (::VRIsPlaceholder returns 1), so the next
+/// access retries the decode, and nothing is ever merged from a changed archive. Saves never replace a failed placeholder with
+/// an empty library: a save that would need to copy or decode its archive fails instead.
+const uint64_t FILEIO_LAZY_LIBRARIES = ((uint64_t)1 << 12);
+
+/// Signals that large vector, stream and DDS property values should be stored once per unique payload when saving
+/// a VRNative file, with duplicates referring to the first copy. Candidate duplicates are found by a 128-bit content hash
+/// and then compared byte for byte, so payloads that merely share a hash are stored separately. Loading such a file shares each unique
+/// payload between all the nodes that use it. Files saved with this flag cannot be read by versions that predate it.
+/// The bytes saved on disk are reported by ::VRGetLastSaveStats, and the bytes saved in memory by ::VRGetSharedPropertyStats.
+const uint64_t FILEIO_DEDUPLICATE = ((uint64_t)1 << 13);
+#endif
+
 /// Signals that the nodes siblings should be saved.
 const uint64_t FILEIO_SAVE_SIBLINGS_TOO = ((uint64_t)1 << 32);
 
@@ -285,6 +412,24 @@ const uint64_t FILEIO_FILE_FORMAT_HUMAN = ((uint64_t)1 << 34);
 /// Signals that the save/load operation should determine the file format from the file extension. 
 const uint64_t FILEIO_FILE_FORMAT_GUESS = ((uint64_t)1 << 35);
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// Signals that VRNative property blocks should be compressed with LZ4 when saving (fast, moderate compression).
+/// Blocks are compressed and decompressed in parallel, and each block records its codec so no flag is needed to load it.
+/// Payloads that are already compressed (e.g. DDS textures) are stored raw.
+/// Cannot be combined with ::FILEIO_COMPRESS_ZSTD; passing both fails the save with ::VRTREE_API_INVALID_PARAMETER.
+/// Files saved with this flag cannot be read by versions that predate it.
+const uint64_t FILEIO_COMPRESS_LZ4 = ((uint64_t)1 << 36);
+
+/// Signals that VRNative property blocks should be compressed with zstd when saving (slower, better compression).
+/// Cannot be combined with ::FILEIO_COMPRESS_LZ4. Files saved with this flag cannot be read by versions that predate it.
+/// @see FILEIO_COMPRESS_LZ4
+const uint64_t FILEIO_COMPRESS_ZSTD = ((uint64_t)1 << 37);
+
+/// Signals that VRText files should write floating point values with the fixed precision used by earlier versions,
+/// rather than the shortest text that reads back to the same value. Useful to keep diffs small against files saved by older versions.
+const uint64_t FILEIO_TEXT_FIXED_PRECISION = ((uint64_t)1 << 38);
+#endif
+
 /// @}
 
 /// @defgroup api_builder_flags Build Filter flags
@@ -309,6 +454,84 @@ const uint32_t BUILDFILTER_ALLOW_INVALID_ATTRIBS = (1 << 4);
 
 /// @}
 
+#if defined(VRAPI_INTERNAL) || defined(VRTREE_API_PREVIEW)
+/// @defgroup api_clone_flags Clone flags
+/// Flags that can be passed to the `cloneFlags` parameter on ::VRCloneNodeEx
+/// @{
+
+/// Signals that the descendants of the node should be cloned too
+const uint32_t CLONE_RECURSIVE = (1 << 0);
+
+/// Signals that property values should be copied immediately rather than shared copy-on-write with the source node
+const uint32_t CLONE_DEEP_COPY = (1 << 1);
+
+/// @}
+
+/// @defgroup api_diff_changes Diff changes
+/// Kinds of change reported to a ::NodeDiffFunc by ::VRDiffSubtrees
+/// @{
+
+/// A node exists in the second subtree but not in the first
+const uint32_t DIFF_CREATED = 0;
+
+/// A node exists in the first subtree but not in the second
+const uint32_t DIFF_DELETED = 1;
+
+/// A node has a different parent in the second subtree, or its order relative to its matched siblings has changed
+/// (only the minimal set of reordered siblings is reported; see ::VRDiffSubtrees)
+const uint32_t DIFF_MOVED = 2;
+
+/// A node has a different name in the second subtree
+const uint32_t DIFF_RENAMED = 3;
+
+/// A property value differs between the two nodes. Reported once per changed property.
+const uint32_t DIFF_PROPERTY_CHANGED = 4;
+
+/// @}
+
+/// @defgroup api_index_kinds Property index kinds
+/// Kinds of index that can be passed to ::VRCreatePropertyIndex
+/// @{
+
+/// A hash index, supporting exact value lookups
+const uint32_t PROPERTY_INDEX_HASH = 0;
+
+/// An ordered index, supporting exact value and range lookups
+const uint32_t PROPERTY_INDEX_ORDERED = 1;
+
+/// @}
+
+/// @defgroup api_bounds_flags Bounds flags
+/// Flags that can be passed to the `flags` parameter on ::VRComputeBounds
+/// @{
+
+/// Signals that the bounds should be expressed in the local space of the root node rather than world space
+const uint32_t BOUNDS_LOCAL = (1 << 0);
+
+/// Signals that nodes which are not visible (and their descendants) should be excluded
+const uint32_t BOUNDS_VISIBLE_ONLY = (1 << 1);
+
+/// Signals that cached per-node bounds should be discarded and recomputed
+const uint32_t BOUNDS_NO_CACHE = (1 << 2);
+
+/// @}
+
+/// @defgroup api_broadphase Broad phase algorithms
+/// Algorithms that can be passed to ::VRSetBroadPhase to find candidate pairs for Touch and Break events
+/// @{
+
+/// Sorts bounds along each axis and reports overlapping intervals. Best for many bodies with coherent motion.
+const uint32_t BROADPHASE_SWEEP_AND_PRUNE = 0;
+
+/// Buckets bounds into a uniform grid. Best for many bodies of similar size.
+const uint32_t BROADPHASE_UNIFORM_GRID = 1;
+
+/// Tests every pair of bodies. Only suitable for very small numbers of bodies.
+const uint32_t BROADPHASE_BRUTE_FORCE = 2;
+
+/// @}
+#endif
+
 /// @defgroup api_loggingmask Logging masks
 /// Flags that control the level of API error reporting. These can be combined.
 /// @{